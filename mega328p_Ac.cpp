@@ -5,6 +5,7 @@
 #include <avr/interrupt.h>
 using u8 = uint8_t;
 #define SA static auto
+#define SCA static constexpr auto
 
 /*---------------------------------------------------------------------
     Ac - Analog Comparator - mega328p
@@ -42,10 +43,15 @@ SA  negSel      (AINNEG e)      {
                                     ain1Analog();
                                 } else {
                                     reg.aDEN = 0;
+                                    reg.aCME = 1;
                                     reg.mUX = e;
                                 }
                                 }
 
+                                //adc mux only, when negSel already done
+                                //for an ADCn input (ACME set, ADEN off)
+SA  muxSel      (AINNEG e)      { reg.mUX = e; }
+
 SA  posSel      (AINPOS e)      {
                                 reg.aCBG = e;
                                 if( e == AIN0 ) ain0Analog();
@@ -61,6 +67,7 @@ SA  irqOff      ()              { reg.aCIE = 0; }
 
 SA  isFlag      ()              { return reg.aCI; }
 SA  clearFlag   ()              { reg.aCI = 1; } //hardware does when using isr
+SA  isOutHigh   ()              { return reg.aCO; }
 
 SA  on          ()              { reg.aCD = 0; } //default
 SA  off         ()              { irqOff(); reg.aCD = 1; }
@@ -121,6 +128,73 @@ SA  on          (AINNEG n, AINPOS p, IRQMODE m, bool sei = true) {
 
 
 
+/*---------------------------------------------------------------------
+    AcScan - round-robin scan of up to 8 negative inputs
+    
+    call tick from a timer isr, each tick reads the channel selected
+    in the previous tick (so the mux has a full tick to settle), then
+    selects the next channel- one ACSR read, one ADMUX read-modify-write
+    per tick (ACME/ADEN are set once in on, so only ADC0-ADC7 allowed)
+    tick returns true when a sweep is done and something changed
+
+    using Scan = AcScan<Ac::ADC0, Ac::ADC1, Ac::ADC4, Ac::ADC5>;
+    Scan::on( Ac::BANDGAP );
+    //in timer isr- if( Scan::tick() ) ... Scan::result(), Scan::changed()
+---------------------------------------------------------------------*/
+template<Ac::AINNEG ...Negs_>
+struct AcScan {
+
+    static_assert( sizeof...(Negs_) >= 1 and sizeof...(Negs_) <= 8,
+                   "AcScan needs 1 to 8 channels" );
+    static_assert( ((Negs_ != Ac::AIN1) and ...),
+                   "AcScan channels are ADC0-ADC7 only (mux), not AIN1" );
+
+//===========
+    private:
+//===========
+
+    static constexpr Ac::AINNEG list_[]{ Negs_... };
+    SCA count_{ sizeof...(Negs_) };
+
+    static inline u8 idx_;                  //channel currently selected
+    static inline u8 sweep_;                //sweep in progress, bit per channel
+    static inline volatile u8 result_;      //last complete sweep
+    static inline volatile u8 changed_;     //bits changed in last sweep
+
+//===========
+    public:
+//===========
+
+                //irq not used, flag is meaningless when switching channels
+SA  on          (Ac::AINPOS p)  {
+                    idx_ = 0;
+                    sweep_ = 0;
+                    Ac::irqOff();
+                    Ac::on( list_[0], p );
+                }
+SA  off         ()              { Ac::off(); }
+
+SA  tick        ()              {
+                    if( Ac::isOutHigh() ) sweep_ or_eq (1<<idx_);
+                    bool done = ++idx_ >= count_;
+                    if( done ){
+                        idx_ = 0;
+                        changed_ = result_ xor sweep_;
+                        result_ = sweep_;
+                        sweep_ = 0;
+                    }
+                    if( count_ > 1 ) Ac::muxSel( list_[idx_] ); //ACME set by on()
+                    return done and changed_;
+                }
+
+                //bit n is channel n of the list (not the AINNEG value)
+SA  result      ()              { return result_; }
+SA  changed     ()              { return changed_; }
+
+};
+
+
+
 [[ using gnu : signal, used ]] //effectively same as ISR macro
 void ANALOG_COMP_vect(){
     //do something
@@ -6,6 +6,7 @@ https://godbolt.org/z/3anT8G
      inline vars)
 ---------------------------------------------------------------------*/
 #include <avr/io.h>
+#include <avr/interrupt.h>
 #include <stdbool.h>
 
 using u8 = uint8_t;
@@ -89,18 +90,16 @@ struct Pin {
     //register struct access
     
     //public to allow register access
-    //  Pin<PA0>::vport->OUT = 0b10101010; //write to vportA multiple pins
+    //  Pin<A0>::vport().OUT = 0b10101010; //write to vportA multiple pins
     //  or for any other reason direct register access is wanted
 
-    //this online compiler does not support using gcc >5.4.0 when a mega4809
-    //is specified as the mcu, so this is what you can do if C++17 available-
-    //static inline volatile Vport&   vport  { *reinterpret_cast<Vport*>(baseAddrV_) }; 
-    //static inline volatile Pinctrl& pinctrl{ *reinterpret_cast<Pinctrl*>(baseAddr_+0x10) };
-
-    //without C++17, we have to init these outside the struct, which as you will see
-    //looks quite ugly because templates involved :(
-    static volatile Vport&   vport;
-    static volatile Pinctrl& pinctrl; 
+    //the address is a compile time constant, so every access ends up as a
+    //direct sbi/cbi/in/out/lds/sts- there is no reference object stored or
+    //loaded, and no init outside the struct (C++17 inline vars not needed)
+                [[gnu::always_inline]]
+SA  vport       () -> volatile Vport&   { return *reinterpret_cast<volatile Vport*>(baseAddrV_); }
+                [[gnu::always_inline]]
+SA  pinctrl     () -> volatile Pinctrl& { return *reinterpret_cast<volatile Pinctrl*>(baseAddr_+0x10); }
 
     //==========
         private:
@@ -140,7 +139,7 @@ SCA init_   (initT& it, PINS::ISCMODE e, Ts... ts) {
             //no more arguments, set from accumulated values
 SCA init_   (initT& it) { 
                 if( it.PINCTRL.ISC bitand 3 ) clearFlag(); //if any irq mode, clear flag
-                pinctrl.PINCTRL = it.PINCTRL.PINCTRL;
+                pinctrl().PINCTRL = it.PINCTRL.PINCTRL;
                 if(it.DIR) on(it.VAL);
                 ioMode(PINS::IOMODE(it.DIR));
             }
@@ -169,9 +168,9 @@ SA  deinit      (){ analog(); }
  
     //io mode
 
-SA  output      ()  { vport.DIRb = 1; }
-SA  input       ()  { vport.DIRb = 0; } 
-SA  analog      ()  { pinctrl.PINCTRL = PINS::INPUT_DISABLE; input(); }
+SA  output      ()  { vport().DIRb = 1; }
+SA  input       ()  { vport().DIRb = 0; } 
+SA  analog      ()  { pinctrl().PINCTRL = PINS::INPUT_DISABLE; input(); }
 SA  ioMode      (PINS::IOMODE e) { 
                     if     ( e == PINS::INPUT )  input(); 
                     else if( e == PINS::OUTPUT ) output(); 
@@ -180,38 +179,285 @@ SA  ioMode      (PINS::IOMODE e) {
 
     //pinctrl properties
 
-SA  invertOn    ()                  { pinctrl.INVEN = 1; }
-SA  invertOff   ()                  { pinctrl.INVEN = 0; }
-SA  pullupOn    ()                  { pinctrl.PULLUP = 1; }
-SA  pullupOff   ()                  { pinctrl.PULLUP = 0; }
-SA  inMode      (PINS::ISCMODE e)   { pinctrl.ISC = e; }
+SA  invertOn    ()                  { pinctrl().INVEN = 1; }
+SA  invertOff   ()                  { pinctrl().INVEN = 0; }
+SA  pullupOn    ()                  { pinctrl().PULLUP = 1; }
+SA  pullupOff   ()                  { pinctrl().PULLUP = 0; }
+SA  inMode      (PINS::ISCMODE e)   { pinctrl().ISC = e; }
 
     //irq flags
 
-SA  clearFlag   ()  { vport.INTFLAGb = 1; }
-SA  isFlag      ()  { return vport.INTFLAGb; }  
+SA  clearFlag   ()  { vport().INTFLAGb = 1; }
+SA  isFlag      ()  { return vport().INTFLAGb; }  
 
     //pin state
 
-SA  on          ()          { vport.OUTb = 1; }       
-SA  off         ()          { vport.OUTb = 0; } 
+SA  on          ()          { vport().OUTb = 1; }       
+SA  off         ()          { vport().OUTb = 0; } 
 SA  on          (bool tf)   { if(tf) on(); else off(); } 
-SA  toggle      ()          { vport.INb = 1; }  
-SA  isOn        ()          { return vport.INb; }
+SA  toggle      ()          { vport().INb = 1; }  
+SA  isOn        ()          { return vport().INb; }
 SA  isOff       ()          { return not isOn(); }
 
     // ... more functions
 
 };
-//without C++17 inline variables, we need to do this to init the
-//register access references
-template<PINS::PIN Pin_>
-volatile typename Pin<Pin_>::Vport& Pin<Pin_>::vport{ *reinterpret_cast<Vport*>(baseAddrV_) }; 
-template<PINS::PIN Pin_>
-volatile typename Pin<Pin_>::Pinctrl& Pin<Pin_>::pinctrl{ *reinterpret_cast<Pinctrl*>(baseAddr_+0x10) };
  
 
 
+/*---------------------------------------------------------------------
+    PinList - a list of pins, for classes that work on a whole port
+---------------------------------------------------------------------*/
+template<PINS::PIN ...Ps_>
+struct PinList {
+
+    SCA count       { sizeof...(Ps_) };
+
+SCA pin         (u8 i)  { PINS::PIN a[]{ Ps_... }; return a[i]; }
+SCA port        ()      { return pin(0)/8; }
+SCA bit         (u8 i)  { return u8(1<<(pin(i)%8)); }
+SCA mask        ()      { 
+                            u8 m = 0; 
+                            for( u8 i = 0; i < count; i++ ) m or_eq bit(i); 
+                            return m; 
+                        }
+SCA samePort    ()      { 
+                            for( u8 i = 1; i < count; i++ ) if( pin(i)/8 != port() ) return false;
+                            return true;
+                        }
+
+};
+
+/*---------------------------------------------------------------------
+    Keypad - key/switch matrix, rows and columns each on a single port
+
+    rows are driven low one at a time (output low, others input), 
+    columns are inputs with pullups, a pressed key reads low
+    each row step is a single DIRTGL write (previous row off, next row
+    on) and a single VPORT IN read of all columns
+
+    call step from a timer isr (the row selected in the previous step is
+    read, so has a full tick to settle), or scan to do all rows now
+    (scan waits Settle_ cpu cycles between rows, so a column released
+    by the previous row has time to be pulled back up before the read)
+    step/scan return true when a complete scan has key changes, which
+    are then read one at a time with event
+
+    if a scan looks like ghosting (2 rows share a pressed column, and
+    there is more than 1 pressed column between them) it is ignored
+    and the previous key state is kept
+
+    using Keys = Keypad< PinList<D0,D1,D2,D3>, PinList<C0,C1,C2,C3> >;
+    Keys::init();
+    if( Keys::scan() ){ u8 k; bool down; while( Keys::event(k,down) ){...} }
+---------------------------------------------------------------------*/
+template<typename Rows_, typename Cols_, u16 Settle_ = 64>
+struct Keypad {
+
+    static_assert( Rows_::samePort(), "row pins must be on the same port" );
+    static_assert( Cols_::samePort(), "column pins must be on the same port" );
+    static_assert( Rows_::port() != Cols_::port() or 
+                   (Rows_::mask() bitand Cols_::mask()) == 0,
+                   "row and column pins overlap" );
+
+    //==========
+        private:
+    //==========
+
+    //constants
+
+    SCA rows_       { Rows_::count };
+    SCA cols_       { Cols_::count };
+    SCA rowAddr_    { Rows_::port() * 0x20 + 0x400 };   //row Portn base address
+    SCA colAddr_    { Cols_::port() * 0x20 + 0x400 };   //col Portn base address
+    SCA colAddrV_   { Cols_::port() * 4 };              //col Vportn base address
+
+    //scan state (step can run in an isr, so what is also read or
+    //cleared by event/isDown/isGhost is volatile)
+
+    struct stateT {
+        u8 row;                 //row currently driven
+        volatile bool ghost;    //last complete scan was ghosted
+        u8 scan[rows_];         //scan in progress, pressed column bits
+        volatile u8 keys[rows_];    //last good scan, pressed column bits
+        volatile u8 changed[rows_]; //column bits changed, cleared by event
+    };
+    static stateT st_;
+
+                //Portn DIRSET/DIRCLR/DIRTGL/OUTCLR, PINnCTRL
+SA  portReg_    (u16 addr, u8 offset, u8 v) { *(volatile u8*)(addr+offset) = v; }
+SA  colsIn_     ()  { return *(volatile u8*)(colAddrV_+2); } //Vportn IN
+
+                //complete scan, check for ghosting and update keys
+SA  sweep_      ()  {
+                    for( u8 i = 0; i < rows_; i++ ){
+                        for( u8 j = i+1; j < rows_; j++ ){
+                            u8 both = st_.scan[i] bitor st_.scan[j];
+                            if( (st_.scan[i] bitand st_.scan[j]) and
+                                (both bitand (both-1)) ){ //more than 1 bit
+                                st_.ghost = true;
+                                return false;
+                            }
+                        }
+                    }
+                    st_.ghost = false;
+                    bool any = false;
+                    for( u8 i = 0; i < rows_; i++ ){
+                        u8 ch = st_.keys[i] xor st_.scan[i];
+                        st_.changed[i] or_eq ch;
+                        st_.keys[i] = st_.scan[i];
+                        if( ch ) any = true;
+                    }
+                    return any;
+                }
+
+    //==========
+        public:
+    //==========
+
+                //rows- output low when selected, input when not
+                //cols- input, pullup
+SA  init        ()  {
+                    portReg_( rowAddr_, 2, Rows_::mask() );     //DIRCLR
+                    portReg_( rowAddr_, 6, Rows_::mask() );     //OUTCLR
+                    portReg_( colAddr_, 2, Cols_::mask() );     //DIRCLR
+                    for( u8 i = 0; i < cols_; i++ ){
+                        portReg_( colAddr_, 0x10 + Cols_::pin(i)%8, 0x08 ); //PULLUPEN
+                    }
+                    st_ = stateT{};
+                    portReg_( rowAddr_, 1, Rows_::bit(0) );     //DIRSET, row 0
+                }
+SA  deinit      ()  { portReg_( rowAddr_, 2, Rows_::mask() ); } //all rows off
+
+SA  step        ()  {
+                    u8 r = st_.row;
+                    st_.scan[r] = compl colsIn_() bitand Cols_::mask();
+                    u8 n = (r+1 == rows_) ? 0 : r+1;
+                    if( rows_ > 1 ) portReg_( rowAddr_, 3, Rows_::bit(r) bitor Rows_::bit(n) );
+                    st_.row = n;
+                    return n == 0 ? sweep_() : false;
+                }
+SA  scan        ()  { 
+                    bool any = false;
+                    for( u8 i = 0; i < rows_; i++ ){
+                        if( i ) __builtin_avr_delay_cycles( Settle_ );
+                        any = step();
+                    }
+                    return any;
+                }
+
+                //key = row * number of columns + column (list index, not pin)
+                //the changed bit is cleared with irq's off, as step (in an
+                //isr) may be setting other bits in the same byte
+SA  event       (u8& key, bool& down) {
+                    for( u8 r = 0; r < rows_; r++ ){
+                        if( not st_.changed[r] ) continue;
+                        for( u8 c = 0; c < cols_; c++ ){
+                            u8 bm = Cols_::bit(c);
+                            if( not (st_.changed[r] bitand bm) ) continue;
+                            u8 sreg = SREG;
+                            cli();
+                            st_.changed[r] and_eq compl bm;
+                            SREG = sreg;
+                            key = r * cols_ + c;
+                            down = st_.keys[r] bitand bm;
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+SA  isDown      (u8 key)    { return st_.keys[key/cols_] bitand Cols_::bit(key%cols_); }
+SA  isGhost     ()          { return st_.ghost; }
+
+};
+//without C++17 inline variables, the state also needs to be
+//defined outside the struct
+template<typename Rows_, typename Cols_, u16 Settle_>
+typename Keypad<Rows_,Cols_,Settle_>::stateT Keypad<Rows_,Cols_,Settle_>::st_;
+
+/*---------------------------------------------------------------------
+    PinSleep - save all port pin state, go to low power, restore
+
+    all pins not in the Keep_ list are set to input with the digital
+    input buffer disabled (no pullup), which is the lowest power state
+    pins in the Keep_ list are not touched (wake sources, pins that
+    need to hold their state while sleeping, etc.)
+    the state is saved per port (VPORT DIR, PINnCTRL), so no pin needs
+    to be re-initialized on wake (OUT is not changed, so is not saved)
+
+    using Sleep = PinSleep<A0, F6>;   //A0 and F6 left alone
+    Sleep::enter(); 
+    //sleep
+    Sleep::exit();
+---------------------------------------------------------------------*/
+template<PINS::PIN ...Keep_>
+struct PinSleep {
+
+    //==========
+        private:
+    //==========
+
+    //constants
+
+    SCA ports_      { 6 };  //A-F
+
+                //Keep_ pin bitmask of a port (leading 0 so Keep_ can be empty)
+SCA keepMask_   (u8 port) {
+                    u8 a[]{ 0, u8(Keep_/8 == port ? 1<<(Keep_%8) : 0)... };
+                    u8 m = 0;
+                    for( auto v : a ) m or_eq v;
+                    return m;
+                }
+
+    //saved state
+
+    struct portT {
+        u8 DIR;
+        u8 PINCTRL[8];
+    };
+    static portT save_[ports_];
+
+SA  vport_      (u8 port)  { return (volatile u8*)(port * 4); }           //DIR
+SA  pinctrl_    (u8 port)  { return (volatile u8*)(port * 0x20 + 0x410); }//PIN0CTRL
+
+    //==========
+        public:
+    //==========
+
+SA  enter       ()  {
+                    for( u8 p = 0; p < ports_; p++ ){
+                        auto vp = vport_( p );
+                        auto pc = pinctrl_( p );
+                        u8 keep = keepMask_( p );
+                        save_[p].DIR = vp[0];
+                        for( u8 i = 0; i < 8; i++ ) save_[p].PINCTRL[i] = pc[i];
+                        vp[0] = save_[p].DIR bitand keep; //not kept- input
+                        for( u8 i = 0; i < 8; i++ ){
+                            if( keep bitand (1<<i) ) continue;
+                            pc[i] = PINS::INPUT_DISABLE;
+                        }
+                    }
+                }
+                //restore pin control first, direction last
+SA  exit        ()  {
+                    for( u8 p = 0; p < ports_; p++ ){
+                        auto vp = vport_( p );
+                        auto pc = pinctrl_( p );
+                        u8 keep = keepMask_( p );
+                        for( u8 i = 0; i < 8; i++ ){
+                            if( keep bitand (1<<i) ) continue;
+                            pc[i] = save_[p].PINCTRL[i];
+                        }
+                        vp[0] = (vp[0] bitand keep) bitor (save_[p].DIR bitand compl keep);
+                    }
+                }
+
+};
+//without C++17 inline variables, the saved state also needs to be
+//defined outside the struct
+template<PINS::PIN ...Keep_>
+typename PinSleep<Keep_...>::portT PinSleep<Keep_...>::save_[PinSleep<Keep_...>::ports_];
+
 /*---------------------------------------------------------------------
     inline delay using _delay_ms
 ---------------------------------------------------------------------*/
@@ -10,6 +10,8 @@
 
 using u8 = uint8_t;
 using u16 = uint16_t;
+using u32 = uint32_t;
+using i16 = int16_t;
 #define SA static auto
 #define SCA static constexpr auto
 
@@ -53,6 +55,31 @@ namespace PINS {
     enum INITVAL { INITOFF, INITON } ;
 }
 
+/*---------------------------------------------------------------------
+    EVSYS namespace - event generators and users - ATmega4809
+    generator values go into CHANNELn, users are an index into USERn
+---------------------------------------------------------------------*/
+namespace EVSYS {
+    enum GEN : u8 { 
+        OFF, UPDI, RTC_OVF = 6, RTC_CMP, 
+        RTC_PIT0, RTC_PIT1, RTC_PIT2, RTC_PIT3, //even/odd channel differ
+        CCL_LUT0 = 0x10, CCL_LUT1, CCL_LUT2, CCL_LUT3,
+        AC0_OUT = 0x20, ADC0_RESRDY = 0x24,
+        PORT0_PIN0 = 0x40, PORT1_PIN0 = 0x48, //use Pin<> for these
+        USART0_XCK = 0x60, USART1_XCK, USART2_XCK, USART3_XCK,
+        SPI0_SCK = 0x68,
+        TCA0_OVF = 0x80, TCA0_HUNF, TCA0_CMP0 = 0x84, TCA0_CMP1, TCA0_CMP2,
+        TCB0_CAPT = 0xA0, TCB1_CAPT = 0xA2, TCB2_CAPT = 0xA4, TCB3_CAPT = 0xA6
+    };
+    enum USER : u8 { 
+        CCLLUT0A, CCLLUT0B, CCLLUT1A, CCLLUT1B, 
+        CCLLUT2A, CCLLUT2B, CCLLUT3A, CCLLUT3B,
+        ADC0, EVOUTA, EVOUTB, EVOUTC, EVOUTD, EVOUTE, EVOUTF,
+        USART0, USART1, USART2, USART3,
+        TCA0, TCB0, TCB1, TCB2, TCB3
+    };
+}
+
 /*---------------------------------------------------------------------
     Pin
 ---------------------------------------------------------------------*/
@@ -96,18 +123,16 @@ struct Pin {
     //register struct access
     
     //public to allow register access
-    //  Pin<PA0>::vport->OUT = 0b10101010; //write to vportA multiple pins
+    //  Pin<A0>::vport().OUT = 0b10101010; //write to vportA multiple pins
     //  or for any other reason direct register access is wanted
 
-    //this online compiler does not support using gcc >5.4.0 when a mega4809
-    //is specified as the mcu, so this is what you can do if C++17 available-
-    //static inline volatile Vport&   vport  { *reinterpret_cast<Vport*>(baseAddrV_) }; 
-    //static inline volatile Pinctrl& pinctrl{ *reinterpret_cast<Pinctrl*>(baseAddr_+0x10) };
-
-    //without C++17, we have to init these outside the struct, which as you will see
-    //looks quite ugly because templates involved :(
-    static volatile Vport&   vport;
-    static volatile Pinctrl& pinctrl; 
+    //the address is a compile time constant, so every access ends up as a
+    //direct sbi/cbi/in/out/lds/sts- there is no reference object stored or
+    //loaded, and no init outside the struct (C++17 inline vars not needed)
+                [[gnu::always_inline]]
+SA  vport       () -> volatile Vport&   { return *reinterpret_cast<volatile Vport*>(baseAddrV_); }
+                [[gnu::always_inline]]
+SA  pinctrl     () -> volatile Pinctrl& { return *reinterpret_cast<volatile Pinctrl*>(baseAddr_+0x10); }
 
     //==========
         private:
@@ -147,7 +172,7 @@ SCA init_   (initT& it, PINS::ISCMODE e, Ts... ts) {
             //no more arguments, set from accumulated values
 SCA init_   (initT& it) { 
                 if( it.PINCTRL.ISC bitand 3 ) clearFlag(); //if any irq mode, clear flag
-                pinctrl.PINCTRL = it.PINCTRL.PINCTRL;
+                pinctrl().PINCTRL = it.PINCTRL.PINCTRL;
                 if(it.DIR) on(it.VAL);
                 ioMode(PINS::IOMODE(it.DIR));
             }
@@ -177,9 +202,9 @@ SA  deinit      (){ analog(); }
  
     //io mode
 
-SA  output      ()  { vport.DIRb = 1; }
-SA  input       ()  { vport.DIRb = 0; } 
-SA  analog      ()  { pinctrl.PINCTRL = PINS::INPUT_DISABLE; input(); }
+SA  output      ()  { vport().DIRb = 1; }
+SA  input       ()  { vport().DIRb = 0; } 
+SA  analog      ()  { pinctrl().PINCTRL = PINS::INPUT_DISABLE; input(); }
 SA  ioMode      (PINS::IOMODE e) { 
                     if     ( e == PINS::INPUT )  input(); 
                     else if( e == PINS::OUTPUT ) output(); 
@@ -188,39 +213,38 @@ SA  ioMode      (PINS::IOMODE e) {
 
     //pinctrl properties
 
-SA  invertOn    ()  { pinctrl.INVEN = 1; }
-SA  invertOff   ()  { pinctrl.INVEN = 0; }
-SA  pullupOn    ()  { pinctrl.PULLUP = 1; }
-SA  pullupOff   ()  { pinctrl.PULLUP = 0; }
+SA  invertOn    ()  { pinctrl().INVEN = 1; }
+SA  invertOff   ()  { pinctrl().INVEN = 0; }
+SA  pullupOn    ()  { pinctrl().PULLUP = 1; }
+SA  pullupOff   ()  { pinctrl().PULLUP = 0; }
 SA  inMode      (PINS::ISCMODE e) {
-                    pinctrl->PINCTRL.ISC = e;
+                    pinctrl().ISC = e;
                 }
 
     //irq flags
 
-SA  clearFlag   ()  { vport.INTFLAGb = 1; }
-SA  isFlag      ()  { return vport.INTFLAGb; }  
+SA  clearFlag   ()  { vport().INTFLAGb = 1; }
+SA  isFlag      ()  { return vport().INTFLAGb; }  
 
     //pin state
 
-SA  on          ()          { vport.OUTb = 1; }       
-SA  off         ()          { vport.OUTb = 0; } 
+SA  on          ()          { vport().OUTb = 1; }       
+SA  off         ()          { vport().OUTb = 0; } 
 SA  on          (bool tf)   { if(tf) on(); else off(); } 
-SA  toggle      ()          { vport.INb = 1; }  
-SA  isOn        ()          { return vport.INb; }
+SA  toggle      ()          { vport().INb = 1; }  
+SA  isOn        ()          { return vport().INb; }
 SA  isOff       ()          { return not isOn(); }
 
+    //event generator (for Evsys)
+    //port pins are only available on the channel pair that serves
+    //their port pair- A/B on channels 0,1, C/D on 2,3, E/F on 4,5
+
+SCA evGenOk     (u8 ch)     { return ch/2 == Pin_/16; }
+SCA evGen       (u8)        { return u8(EVSYS::PORT0_PIN0 + (Pin_/8 % 2)*8 + pin_); }
+
     // ... more functions
 
 };
-//without C++17 inline variables, we need to do this to init the
-//register access references
-template<PINS::PIN Pin_>
-volatile typename Pin<Pin_>::Vport& Pin<Pin_>::vport{
-    *reinterpret_cast<Vport*>(baseAddrV_) }; 
-template<PINS::PIN Pin_>
-volatile typename Pin<Pin_>::Pinctrl& Pin<Pin_>::pinctrl{ 
-    *reinterpret_cast<Pinctrl*>(baseAddr_+0x10) };
  
 
 
@@ -235,8 +259,12 @@ struct USART_INST {
     
     static_assert( N_ < 4, "valid USART numbers are 0-3" );
     SCA BASE_ADDR{ 0x800 + N_*0x20 };
+    SCA N{ N_ };
     SCA RxD{ Rx_ }; 
     SCA TxD{ Tx_ };
+    //XDIR is TxD+3 (PB7,PF7 are not on the 48pin package)
+    SCA XDir{ PINS::PIN(Tx_+3) };
+    SCA XDirOk{ Tx_+3 != 15 and Tx_+3 != 47 };
 
     //PORTMUX.USARTROUTEA = 0x05E2, only allowing default/alt (0,1)
     //(2 unused, 3 is none and assuming is never set)
@@ -246,6 +274,8 @@ struct USART_INST {
     }
     SCA txdInit(){ Pin<TxD>::init( PINS::OUTPUT, PINS::INITON ); }
     SCA rxdInit(){ Pin<RxD>::init( PINS::INPUT, PINS::PULLUPON ); }
+    //one-wire, TxD is open drain (ODME), so output and idle high
+    SCA owdInit(){ Pin<TxD>::init( PINS::OUTPUT, PINS::INITON, PINS::PULLUPON ); }
 
 };
 template<typename> struct Usart;
@@ -270,6 +300,8 @@ struct Usart : Inst_ {
     enum RXMODE { NORMAL, CLK2X, GENAUTO, LINAUTO };
     enum PMODE  { DISABLED, EVEN = 2, ODD };
     enum SBMODE { STOP1, STOP2 };
+    enum ABSTATUS { ABOK, ABSOFT, ABSYNCERR, ABTIMEOUT }; //autoBaud result
+    enum RS485MODE{ RS485OFF, RS485EXT, RS485INT };
 
     //============
         private:
@@ -277,27 +309,71 @@ struct Usart : Inst_ {
 
     struct UsartReg; //forward declare, registers are at end of struct
 
+    //TCBn used as a free running counter by syncMeasure
+    //(raw access, as there is no Tcb class in this example)
+    SCA TCB_ADDR{ 0x0A80 };
+    SCA SYNC_TOL{ 8 }; //syncMeasure interval tolerance, 1/8 = 12.5%
+
+                                //syncMeasure without the receiver handling
+                                template<u8 Tcb_>
+SA  syncMeasure_    (u32 timeout) -> u16 {
+                                    static_assert( Tcb_ < 4, "valid TCB numbers are 0-3" );
+                                    auto tcb = (volatile u8*)(TCB_ADDR + Tcb_*0x10);
+                                    auto cnt = (volatile u16*)(tcb + 0x0A);
+                                    *(volatile u16*)(tcb + 0x0C) = 0xFFFF; //CCMP, full range
+                                    tcb[1] = 0;                            //CTRLB, periodic mode
+                                    tcb[0] = 1;                            //CTRLA, DIV1, ENABLE
+                                    using rxd = Pin<Inst_::RxD>;
+                                    u16 t[5];   //falling edges
+                                    u16 rise;   //end of start bit
+                                    for( u8 e = 0; e < 5; e++ ){
+                                        while( rxd::isOff() ) if( not --timeout ) return 0;
+                                        while( rxd::isOn() ) if( not --timeout ) return 0;
+                                        t[e] = *cnt;
+                                        if( e ) continue;
+                                        while( rxd::isOff() ) if( not --timeout ) return 0;
+                                        rise = *cnt;
+                                    }
+                                    u16 clocks = t[4] - t[0];
+                                    u16 avg = clocks/4; //2 bit times
+                                    if( (u16)(rise - t[0]) > avg ) return 0;
+                                    for( u8 i = 0; i < 4; i++ ){
+                                        u16 d = t[i+1] - t[i];
+                                        u16 diff = d > avg ? d - avg : avg - d;
+                                        if( diff > avg/SYNC_TOL ) return 0;
+                                    }
+                                    return reg().RXMODE == CLK2X ? clocks : (clocks+1)/2;
+                                }
+
     //============
         public:
     //============
 
-    //C++17
-    // static inline volatile UsartReg&
-    // reg { *(reinterpret_cast<UsartReg*>(Inst_::BASE_ADDR)) };
+    //register access, compile time constant address (see Pin)
+                                [[gnu::always_inline]]
+SA  reg             () -> volatile UsartReg& { 
+                                    return *reinterpret_cast<volatile UsartReg*>(Inst_::BASE_ADDR); 
+                                }
 
-    // < C++17, init outside struct
-    static volatile UsartReg& reg;
+    //autoBaud result, err is the per-mille difference of the
+    //new baud value from the previous (nominal) baud value
+    //(limited to +/-32767)
+    struct autoBaudT {
+        ABSTATUS status;
+        u16 baud;
+        i16 err;
+    };
 
-SA  isTxEmpty       ()          { return reg.DREIF; }            
+SA  isTxEmpty       ()          { return reg().DREIF; }            
 SA  isTxFull        ()          { return not isTxEmpty(); }
-SA  isTxComplete    ()          { return reg.TXCIF; }
-SA  clearTxComplete ()          { reg.STATUS = 0x40; }
-SA  isRxData        ()          { return reg.RXCIFd; }
-SA  write           (u8 v)      { while( isTxFull() ); reg.TXDATAL = v; }
+SA  isTxComplete    ()          { return reg().TXCIF; }
+SA  clearTxComplete ()          { reg().STATUS = 0x40; }
+SA  isRxData        ()          { return reg().RXCIFd; }
+SA  write           (u8 v)      { while( isTxFull() ); reg().TXDATAL = v; }
 SA  read            (u8& v)     { 
                                     while( not isRxData() );
-                                    u8 err = reg.RXDATAH bitand 0x46;
-                                    v =reg.RXDATAL;
+                                    u8 err = reg().RXDATAH bitand 0x46;
+                                    v =reg().RXDATAL;
                                     return err;
                                 }
                                 //we want this all inline, as the compiler loses
@@ -308,12 +384,172 @@ SA  on              ()          {
                                     Inst_::pmuxSet();
                                     Inst_::txdInit();
                                     Inst_::rxdInit();
-                                    reg.CTRLB = 0xC0; 
+                                    reg().CTRLB = 0xC0; 
                                 }                                
-SA  rxMode          (RXMODE e)  { reg.RXMODE = e;}
-SA  stopBits        (SBMODE e)  { reg.SBMODE = e; }
-SA  parity          (PMODE e)   { reg.PMODE = e; }
-SA  baudReg         (u16 v)     { reg.BAUD = v; }
+
+    //one-wire half duplex
+
+                                //TxD only (open drain + internal loopback to
+                                //rx), RxD pin is not used so is free for 
+                                //other use, an external pullup is normally
+                                //needed on the TxD pin
+                                [[gnu::always_inline]] 
+SA  oneWireOn       ()          {
+                                    Inst_::pmuxSet();
+                                    Inst_::owdInit();
+                                    reg().LBME = 1;
+                                    reg().CTRLB = 0xC8; //RXEN,TXEN,ODME
+                                }
+                                //the receiver is off while we transmit, so
+                                //our own bytes never show up in the rx 
+                                //buffer (no echo to read back and discard),
+                                //but also means no collision detection
+                                //turning the receiver off flushes the rx
+                                //buffer, so a new frame is not started (false
+                                //returned) while there is unread rx data
+SA  owWrite         (u8 v)      { 
+                                    if( reg().RXEN ){ 
+                                        if( isRxData() ) return false;
+                                        clearTxComplete(); 
+                                        reg().RXEN = 0; 
+                                    }
+                                    write( v ); 
+                                    return true;
+                                }
+                                //end of a tx frame, receiver back on when 
+                                //the last stop bit is done (blocking)
+SA  owWriteDone     ()          {
+                                    while( not isTxComplete() );
+                                    clearTxComplete();
+                                    reg().RXEN = 1;
+                                }
+SA  rxMode          (RXMODE e)  { reg().RXMODE = e;}
+SA  stopBits        (SBMODE e)  { reg().SBMODE = e; }
+SA  parity          (PMODE e)   { reg().PMODE = e; }
+SA  baudReg         (u16 v)     { reg().BAUD = v; }
+SA  baudReg         ()          { return reg().BAUD; }
+
+    //rs485
+
+                                //hardware direction control, XDIR pin is 
+                                //driven high from one bit time before the 
+                                //start bit until the stop bit is done
+SA  rs485On         ()          {
+                                    static_assert( Inst_::XDirOk, 
+                                        "no XDIR pin for this usart on this package" );
+                                    Pin<Inst_::XDir>::init( PINS::OUTPUT );
+                                    reg().RS485 = RS485EXT;
+                                }
+SA  rs485Off        ()          { reg().RS485 = RS485OFF; }
+
+                                //Pin driven direction control (any pin, for 
+                                //when XDIR is not available or is in use)
+                                //init options passed on to the pin (LOWISON)
+                                //de pin released from the TXC isr- 
+                                //  rs485PinTx<D4>(); write(..); ...
+                                //  isr: rs485PinIsr<D4, guardCycles>();
+                                template<PINS::PIN De_, typename ...Ts>
+SA  rs485PinOn      (Ts... ts)  {
+                                    Pin<De_>::init( PINS::OUTPUT, ts... );
+                                    clearTxComplete();
+                                    reg().TXCIE = 1;
+                                }
+                                template<PINS::PIN De_>
+SA  rs485PinOff     ()          { reg().TXCIE = 0; Pin<De_>::off(); }
+                                //call before the first write of a frame
+                                template<PINS::PIN De_>
+SA  rs485PinTx      ()          { clearTxComplete(); Pin<De_>::on(); }
+                                //call from the TXC isr, TXC is only set when
+                                //the last stop bit is done and no more data 
+                                //is waiting (the flag is not cleared by the
+                                //hardware when the isr runs, so clear it here
+                                //or the isr would keep firing)
+                                //Guard_ is the bus guard time in cpu cycles
+                                template<PINS::PIN De_, u32 Guard_ = 0>
+SA  rs485PinIsr     ()          {
+                                    clearTxComplete();
+                                    if( Guard_ ) __builtin_avr_delay_cycles( Guard_ );
+                                    Pin<De_>::off();
+                                }
+
+    //auto-baud
+
+SA  isBreak         ()          { return reg().BDF; }
+SA  clearBreak      ()          { reg().STATUS = 0x02; }
+SA  isSyncErr       ()          { return reg().ISFIF; }
+SA  clearSyncErr    ()          { reg().STATUS = 0x08; }
+SA  waitBreak       ()          { reg().STATUS = 0x01; } //WFB
+
+                                //measure the 0x55 sync field in software,
+                                //rxd pin edges timed with TCBn at CLK_PER
+                                //(TCBn is left running)
+                                //start bit + 4 more falling edges = 8 bits,
+                                //BAUD(16x) = 4 * clocks/bit = clocks/2,
+                                //so lowest baud is about F_CPU/8192
+                                //each falling edge interval must be 2 bit
+                                //times within 1/SYNC_TOL of the average, and
+                                //the start bit no longer than 2 bit times,
+                                //else it was not a sync field (break, data)
+                                //receiver is off while measuring, so the sync
+                                //byte at the wrong baud is not received
+                                //returns 0 on timeout (loop count) or if 
+                                //not a sync field
+                                template<u8 Tcb_ = 0>
+SA  syncMeasure     (u32 timeout) -> u16 {
+                                    bool rxen = reg().RXEN;
+                                    reg().RXEN = 0;
+                                    u16 v = syncMeasure_<Tcb_>( timeout );
+                                    reg().RXEN = rxen;
+                                    return v;
+                                }
+
+                                //sync to a break + sync field from the host
+                                //using the hardware auto-baud (GENAUTO or 
+                                //LINAUTO), BAUD is updated by the hardware
+                                //if no break/sync seen (timeout is a loop 
+                                //count) and swFallback is set, syncMeasure 
+                                //is used on the next sync field instead
+                                //usart is left in NORMAL rx mode if the
+                                //software measurement is used
+SA  autoBaud        (RXMODE e, u32 timeout, bool swFallback = false) {
+                                    autoBaudT ab{ ABTIMEOUT, reg().BAUD, 0 };
+                                    u16 nominal = ab.baud;
+                                    rxMode( e );
+                                    reg().STATUS = 0x0B; //clear BDF,ISFIF, set WFB
+                                    for( auto t = timeout; t; t-- ){
+                                        if( isSyncErr() ){ 
+                                            clearSyncErr(); 
+                                            ab.status = ABSYNCERR; 
+                                            break; 
+                                        }
+                                        if( isBreak() ){ 
+                                            clearBreak(); 
+                                            ab.status = ABOK; 
+                                            break; 
+                                        }
+                                    }
+                                    if( ab.status != ABOK and swFallback ){
+                                        rxMode( NORMAL );
+                                        u16 v = syncMeasure( timeout );
+                                        if( v ){ baudReg( v ); ab.status = ABSOFT; }
+                                    }
+                                    ab.baud = reg().BAUD;
+                                    if( nominal ){
+                                        int32_t err = ((int32_t)ab.baud - nominal) * 1000 / nominal;
+                                        if( err > 32767 ) err = 32767; //i16 limits
+                                        if( err < -32767 ) err = -32767;
+                                        ab.err = (i16)err;
+                                    }
+                                    return ab;
+                                }
+
+    //event generator (XCK) and user (IRCOM event input, for Evsys)
+SCA evGenOk         (u8)        { return true; }
+SCA evGen           (u8)        { return u8(EVSYS::USART0_XCK + Inst_::N); }
+SCA evUser          ()          { return u8(EVSYS::USART0 + Inst_::N); }
+                                //the event input replaces RxD, and is
+                                //only used in IRCOM mode (CMODE = 2)
+SA  evUserOn        ()          { reg().CMODE = 2; reg().IREI = 1; }
 
 
     //============
@@ -390,11 +626,111 @@ SA  baudReg         (u16 v)     { reg.BAUD = v; }
     PEDANTIC_RESTORE
 
 };
-//without C++17 inline variables, we need to do this to init the
-//register access references
-template<typename Inst_>
-volatile typename Usart<Inst_>::UsartReg& Usart<Inst_>::reg { 
-    *(reinterpret_cast<UsartReg*>(Inst_::BASE_ADDR)) };
+
+
+
+
+/*------------------------------------------------------------------------------
+    EvGen, EvUser - event generators/users that have no class here
+------------------------------------------------------------------------------*/
+template<EVSYS::GEN G_>
+struct EvGen {
+
+    static_assert( G_ < EVSYS::PORT0_PIN0 or G_ >= EVSYS::USART0_XCK,
+                   "use Pin<> as the generator for port pins" );
+
+SCA evGenOk     (u8)    { return true; }
+SCA evGen       (u8)    { return u8(G_); }
+
+};
+
+template<EVSYS::USER U_>
+struct EvUser {
+
+SCA evUser      ()      { return u8(U_); }
+SA  evUserOn    ()      {} //peripheral enables its own event input
+
+};
+
+using Ac0Out    = EvGen<EVSYS::AC0_OUT>;
+using Tcb0Capt  = EvUser<EVSYS::TCB0>; //TCB0 capture input (TCB0.EVCTRL)
+using Tcb1Capt  = EvUser<EVSYS::TCB1>;
+using Tcb2Capt  = EvUser<EVSYS::TCB2>;
+using Tcb3Capt  = EvUser<EVSYS::TCB3>;
+
+
+
+/*------------------------------------------------------------------------------
+    Evsys - event channel 0-7
+
+    a generator is any type with evGenOk(ch)/evGen(ch) (Pin, Usart, EvGen)
+    a user is any type with evUser()/evUserOn() (Usart, EvUser)
+    the generator is checked against the channel at compile time
+
+    Evsys<0>::route< Pin<A2>, Tcb0Capt >(); //pin edge -> tcb0 capture
+    Evsys<4>::route< Ac0Out, Usart1 >();    //comparator -> usart1 rx
+------------------------------------------------------------------------------*/
+template<u8 Ch_>
+struct Evsys {
+
+    static_assert( Ch_ < 8, "valid EVSYS channels are 0-7" );
+
+    //============
+        private:
+    //============
+
+    struct EvsysReg; //forward declare, registers are at end of struct
+
+                //no more users
+SA  users_      () {}
+                //set each user, pointer args only used to carry the type
+                template<typename User_, typename ...Us>
+SA  users_      (User_*, Us*... us) { user<User_>(); users_( us... ); }
+
+    //============
+        public:
+    //============
+
+    //register access, compile time constant address (see Pin)
+                [[gnu::always_inline]]
+SA  reg         () -> volatile EvsysReg& { return *reinterpret_cast<volatile EvsysReg*>(0x0180); }
+
+                template<typename Gen_>
+SA  generator   ()  {
+                    static_assert( Gen_::evGenOk(Ch_), 
+                                   "generator not available on this channel" );
+                    reg().CHANNEL[Ch_] = Gen_::evGen(Ch_);
+                }
+                template<typename User_>
+SA  user        ()  { 
+                    User_::evUserOn();
+                    reg().USER[User_::evUser()] = Ch_+1; //0 is off, 1 is channel0
+                }
+                template<typename User_>
+SA  userOff     ()  { reg().USER[User_::evUser()] = 0; }
+                //generator and all users in one call
+                template<typename Gen_, typename ...Users_>
+SA  route       ()  { 
+                    generator<Gen_>();
+                    users_( static_cast<Users_*>(nullptr)... );
+                }
+SA  off         ()  { reg().CHANNEL[Ch_] = EVSYS::OFF; }
+SA  strobe      ()  { reg().STROBE = 1<<Ch_; } //software event
+
+    //============
+        private:
+    //============
+
+    // registers
+    struct EvsysReg {
+                 u8 STROBE;             //0x00
+                 u8 unused1[0x10-0x01];
+                 u8 CHANNEL[8];         //0x10
+                 u8 unused2[0x20-0x18];
+                 u8 USER[EVSYS::TCB3+1];//0x20
+    };
+
+};
 
 
 